@@ -17,6 +17,9 @@
 #ifndef __TIZEN_NET_WIFI_DIRECT_H__
 #define __TIZEN_NET_WIFI_DIRECT_H__
 
+#include <stddef.h>
+#include <netinet/in.h>
+#include <time.h>
 #include <tizen.h>
 
 #ifdef __cplusplus
@@ -29,6 +32,31 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief The buffer size to store SSID, including the terminating null byte
+ */
+#define WIFI_DIRECT_SSID_LEN 33
+
+/**
+ * @brief The buffer size to store the name of network interface, including the terminating null byte
+ */
+#define WIFI_DIRECT_INTERFACE_NAME_LEN 16
+
+/**
+ * @brief The buffer size to store IPv4 address string like "192.168.49.1", including the terminating null byte
+ */
+#define WIFI_DIRECT_IP_ADDRESS_STR_LEN 16
+
+/**
+ * @brief The buffer size to store MAC address string like "00:11:22:33:44:55", including the terminating null byte
+ */
+#define WIFI_DIRECT_MAC_ADDRESS_STR_LEN 18
+
+/**
+ * @brief The length of MAC address in bytes
+ */
+#define WIFI_DIRECT_MAC_ADDRESS_LEN 6
+
 /**
  * @brief Enumeration for Wi-Fi Direct error code
  */
@@ -97,6 +125,35 @@ typedef enum {
     WIFI_DIRECT_GROUP_DESTROYED,  /**< Group is destroyed */
 } wifi_direct_connection_state_e;
 
+/**
+ * @brief Enumeration for Wi-Fi Direct automatic reconnection state
+ */
+typedef enum {
+    WIFI_DIRECT_RECONNECT_STARTED,  /**< Automatic reconnection is started */
+    WIFI_DIRECT_RECONNECT_RETRYING,  /**< An attempt failed and the next attempt is scheduled */
+    WIFI_DIRECT_RECONNECT_RECOVERED,  /**< Connection is recovered */
+    WIFI_DIRECT_RECONNECT_GAVE_UP,  /**< The maximum number of attempts is reached */
+    WIFI_DIRECT_RECONNECT_CANCELED,  /**< Automatic reconnection is canceled */
+} wifi_direct_reconnect_state_e;
+
+/**
+ * @brief Enumeration for Wi-Fi Direct IP address assignment method
+ */
+typedef enum {
+    WIFI_DIRECT_IP_ASSIGNMENT_DHCP,  /**< IP address is assigned by DHCP after the group is formed */
+    WIFI_DIRECT_IP_ASSIGNMENT_EAPOL,  /**< IP address is allocated in EAPOL-Key frames during the group formation */
+} wifi_direct_ip_assignment_method_e;
+
+/**
+ * @brief Enumeration for Wi-Fi Direct power profile
+ */
+typedef enum {
+    WIFI_DIRECT_POWER_PROFILE_DEFAULT,  /**< Power save is controlled by the Wi-Fi Direct service as before */
+    WIFI_DIRECT_POWER_PROFILE_LOW_LATENCY,  /**< No power save, shortest listen interval. e.g. game input */
+    WIFI_DIRECT_POWER_PROFILE_BALANCED,  /**< Opportunistic power save */
+    WIFI_DIRECT_POWER_PROFILE_POWER_SAVE,  /**< Opportunistic power save and Notice of Absence, longest listen interval. e.g. idle sync */
+} wifi_direct_power_profile_e;
+
 /**
  * @brief Enumeration for Wi-Fi Direct secondary device type
  */
@@ -178,6 +235,44 @@ typedef enum {
     WIFI_DIRECT_PRIMARY_DEVICE_TYPE_OTHER =  255  /**< Others */
 } wifi_direct_primary_device_type_e;
 
+/**
+ * @brief Makes a key which identifies a pair of primary and secondary device type.
+ * @details Secondary device types reuse the same values across primary device types,
+ * e.g. #WIFI_DIRECT_SECONDARY_DEVICE_TYPE_COMPUTER_PC and #WIFI_DIRECT_SECONDARY_DEVICE_TYPE_PRINTER_PRINTER are both 1.
+ * The key is unique for each pair and is a constant expression, so it can be used as a case label.
+ */
+#define WIFI_DIRECT_DEVICE_TYPE_KEY(primary, secondary) ((((int)(primary)) << 8) | ((int)(secondary) & 0xff))
+
+/**
+ * @brief Wi-Fi Direct structure to store a pair of primary and secondary device type
+ * @remarks The secondary device type is only meaningful together with its primary device type.
+ * @see wifi_direct_get_peer_device_type()
+ */
+typedef struct
+{
+    wifi_direct_primary_device_type_e primary;  /**< Primary category of device */
+    wifi_direct_secondary_device_type_e secondary;  /**< Sub category of device */
+} wifi_direct_device_type_s;
+
+/**
+ * @brief Enumeration for Wi-Fi Direct device type traits
+ * @see wifi_direct_get_device_type_traits()
+ */
+typedef enum {
+    WIFI_DIRECT_DEVICE_TRAIT_NONE = 0x00,  /**< No trait */
+    WIFI_DIRECT_DEVICE_TRAIT_INPUT = 0x01,  /**< Provides user input */
+    WIFI_DIRECT_DEVICE_TRAIT_DISPLAY = 0x02,  /**< Renders video or images */
+    WIFI_DIRECT_DEVICE_TRAIT_AUDIO = 0x04,  /**< Renders or captures audio */
+    WIFI_DIRECT_DEVICE_TRAIT_PRINT = 0x08,  /**< Prints documents */
+    WIFI_DIRECT_DEVICE_TRAIT_CAPTURE = 0x10,  /**< Captures images or documents */
+    WIFI_DIRECT_DEVICE_TRAIT_STORAGE = 0x20,  /**< Stores or serves content */
+    WIFI_DIRECT_DEVICE_TRAIT_NETWORK = 0x40,  /**< Provides network infrastructure */
+    WIFI_DIRECT_DEVICE_TRAIT_PORTABLE = 0x80,  /**< Portable, usually battery powered */
+    WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY = 0x100,  /**< Usually has a screen to display a WPS PIN */
+    WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD = 0x200,  /**< Usually has a keypad to enter a WPS PIN */
+    WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY = 0x400,  /**< Usually headless, so only Push Button Configuration is practical */
+} wifi_direct_device_trait_e;
+
 /**
  * @brief Enumeration for Wi-Fi WPS type
  */
@@ -188,6 +283,15 @@ typedef enum {
     WIFI_DIRECT_WPS_TYPE_PIN_KEYPAD = 0x04,  /**< Provide the keypad to input the PIN */
 } wifi_direct_wps_type_e;
 
+/**
+ * @brief Wi-Fi Direct MAC address in binary form
+ * @remarks Two MAC addresses can be compared with memcmp().
+ */
+typedef struct
+{
+    unsigned char addr[WIFI_DIRECT_MAC_ADDRESS_LEN];  /**< MAC address octets in transmission order */
+} wifi_direct_mac_s;
+
 /**
  * @brief Wi-Fi Direct buffer structure to store result of peer discovery
  */
@@ -204,6 +308,9 @@ typedef struct
     wifi_direct_secondary_device_type_e secondary_device_type;  /**< Sub category of device */
     int supported_wps_types;  /**< The list of supported WPS type.\n The OR operation on #wifi_direct_wps_type_e can be used like #WIFI_DIRECT_WPS_TYPE_PBC | #WIFI_DIRECT_WPS_TYPE_PIN_DISPLAY */
     bool is_p2p_invitation_procedure_supported;  /**< Is capable of processing P2P Invitation Procedure signaling */
+    bool is_stale;  /**< Is restored from peer history and not found by discovery yet */
+    time_t last_seen;  /**< The time when the peer was found last */
+    wifi_direct_mac_s mac_address_raw;  /**< Device's P2P Device Address in binary form */
 } wifi_direct_discovered_peer_info_s;
 
 
@@ -219,8 +326,102 @@ typedef struct
     bool p2p_supported;  /* whether peer is a P2P device */
     wifi_direct_primary_device_type_e   primary_device_type;  /* primary category of device */
     int channel;  /* Operating channel */
+    wifi_direct_mac_s mac_address_raw;  /**< Device's P2P Device Address in binary form */
 } wifi_direct_connected_peer_info_s;
 
+/**
+ * @brief Wi-Fi Direct buffer structure to store score of a candidate channel for own group
+ */
+typedef struct
+{
+    int channel;  /**< The candidate channel */
+    int peer_count;  /**< Number of discovered peers listening on the channel */
+    int group_owner_count;  /**< Number of discovered Group Owners operating on the channel */
+    int interference;  /**< Measured interference level of the channel, 0 ~ 100. The higher, the more congested */
+    int score;  /**< Score of the channel, 0 ~ 100. The higher, the better */
+} wifi_direct_channel_candidate_info_s;
+
+/**
+ * @brief Wi-Fi Direct buffer structure to store parameters of a power profile
+ * @details All durations are in microseconds, the unit of Notice of Absence in the P2P specification.
+ * The listen interval and the client traffic window are defined in TUs (1 TU = 1024 microseconds) by the specification,
+ * so they must be multiples of 1024.
+ * @see wifi_direct_set_power_profile_params()
+ */
+typedef struct
+{
+    unsigned int listen_interval_usec;  /**< Interval of Listen state, in microseconds. Multiple of 1024 */
+    bool opportunistic_ps;  /**< Whether opportunistic power save is used when your device is group owner */
+    unsigned int ct_window_usec;  /**< Client traffic window of opportunistic power save, in microseconds. Multiple of 1024 */
+    int noa_count;  /**< Number of absence periods of Notice of Absence. 0 disables Notice of Absence, 255 repeats continuously */
+    unsigned int noa_duration_usec;  /**< Duration of each absence period, in microseconds */
+    unsigned int noa_interval_usec;  /**< Interval between the start of absence periods, in microseconds */
+} wifi_direct_power_profile_params_s;
+
+/**
+ * @brief Wi-Fi Direct buffer structure to store measured latency and duty cycle
+ * @see wifi_direct_get_power_stats()
+ */
+typedef struct
+{
+    wifi_direct_power_profile_e profile;  /**< The power profile applied while measuring */
+    unsigned int average_latency_usec;  /**< Average latency of frames, in microseconds */
+    unsigned int max_latency_usec;  /**< Maximum latency of frames, in microseconds */
+    int duty_cycle_percent;  /**< Percentage of time the radio is awake */
+    unsigned int sample_count;  /**< Number of frames measured */
+} wifi_direct_power_stats_s;
+
+/**
+ * @brief Wi-Fi Direct buffer structure to store timestamps of IP address assignment
+ * @details Timestamps are taken from CLOCK_MONOTONIC, in microseconds. A timestamp is 0 if the phase did not happen,
+ * e.g. DHCP phases with #WIFI_DIRECT_IP_ASSIGNMENT_EAPOL.
+ * @see wifi_direct_get_ip_assignment_timing()
+ */
+typedef struct
+{
+    wifi_direct_ip_assignment_method_e method;  /**< The method used to assign the IP address */
+    unsigned long long connection_rsp_usec;  /**< When the group formation is completed */
+    unsigned long long dhcp_discover_usec;  /**< When DHCPDISCOVER is sent or received */
+    unsigned long long dhcp_offer_usec;  /**< When DHCPOFFER is sent or received */
+    unsigned long long dhcp_request_usec;  /**< When DHCPREQUEST is sent or received */
+    unsigned long long dhcp_ack_usec;  /**< When DHCPACK is sent or received */
+    unsigned long long ip_assigned_usec;  /**< When the IP address is assigned */
+} wifi_direct_ip_assignment_timing_s;
+
+/**
+ * @brief Wi-Fi Direct buffer structure to store the result of a background scan window
+ * @see wifi_direct_start_background_discovery()
+ */
+typedef struct
+{
+    int listen_msec;  /**< Time spent in Listen state during the window, in milliseconds */
+    int search_msec;  /**< Time spent in Search state during the window, in milliseconds */
+    int peers_found;  /**< Number of peers found during the window */
+    int throughput_before_kbps;  /**< Group throughput measured just before the window, in kbps */
+    int throughput_during_kbps;  /**< Group throughput measured during the window, in kbps */
+} wifi_direct_scan_window_info_s;
+
+/**
+ * @brief The handle of the peer table shared by the Wi-Fi Direct service
+ * @see wifi_direct_peer_table_open()
+ */
+typedef struct wifi_direct_peer_table_s* wifi_direct_peer_table_h;
+
+/**
+ * @brief Wi-Fi Direct buffer structure to store statistics of event delivery
+ * @see wifi_direct_set_discovery_coalescing_window()
+ * @see wifi_direct_set_connection_state_hysteresis()
+ */
+typedef struct
+{
+    unsigned int discovery_found_received;  /**< Number of #WIFI_DIRECT_DISCOVERY_FOUND events received from the Wi-Fi Direct service */
+    unsigned int discovery_found_delivered;  /**< Number of #WIFI_DIRECT_DISCOVERY_FOUND events delivered to wifi_direct_discovery_state_chagned_cb() */
+    unsigned int discovery_found_merged;  /**< Number of #WIFI_DIRECT_DISCOVERY_FOUND events merged into another delivery */
+    unsigned int connection_state_received;  /**< Number of connection state events received from the Wi-Fi Direct service */
+    unsigned int connection_state_delivered;  /**< Number of connection state events delivered to wifi_direct_connection_state_changed_cb() */
+    unsigned int connection_state_dropped;  /**< Number of connection state events dropped because the peer was connected again within the hysteresis, including the events held after the disconnection */
+} wifi_direct_event_stats_s;
+
 /**
  * @brief Called when the state of discovery is changed.
  * @param[in] error_code  The error code
@@ -276,6 +477,57 @@ typedef void (*wifi_direct_connection_state_changed_cb) (wifi_direct_error_e err
  */
 typedef void (*wifi_direct_client_ip_address_assigned_cb) (const char* mac_address, const char* ip_address, const char* interface_address, void *user_data);
 
+/**
+ * @brief Called when the state of connection is changed, with the MAC address in binary form.
+ * @details This callback is the same as wifi_direct_connection_state_changed_cb() except that the MAC address is not formatted as a string.
+ * @param[in] error_code  The error code
+ * @param[in] connection_state  The connection state
+ * @param[in] mac_address  The MAC address of connection peer
+ * @param[in] user_data  The user data passed from the callback registration function
+ * @see wifi_direct_connection_state_changed_cb()
+ * @see wifi_direct_set_connection_state_changed_mac_cb()
+ * @see wifi_direct_unset_connection_state_changed_mac_cb()
+ */
+typedef void (*wifi_direct_connection_state_changed_mac_cb) (wifi_direct_error_e error_code, wifi_direct_connection_state_e connection_state, const wifi_direct_mac_s* mac_address, void *user_data);
+
+/**
+ * @brief Called when IP address of client is assigned when your device is group owner, with the addresses in binary form.
+ * @details This callback is the same as wifi_direct_client_ip_address_assigned_cb() except that the addresses are not formatted as strings.
+ * @param[in] mac_address  The MAC address of connection peer
+ * @param[in] ip_address  The IP address of connection peer in network byte order
+ * @param[in] interface_address  The interface address of connection peer
+ * @param[in] user_data  The user data passed from the callback registration function
+ * @see wifi_direct_client_ip_address_assigned_cb()
+ * @see wifi_direct_set_client_ip_address_assigned_mac_cb()
+ * @see wifi_direct_unset_client_ip_address_assigned_mac_cb()
+ */
+typedef void (*wifi_direct_client_ip_address_assigned_mac_cb) (const wifi_direct_mac_s* mac_address, const struct in_addr* ip_address, const wifi_direct_mac_s* interface_address, void *user_data);
+
+/**
+ * @brief Called when the state of automatic reconnection is changed.
+ * @param[in] error_code  The error code of the last attempt
+ * @param[in] reconnect_state  The automatic reconnection state
+ * @param[in] mac_address  The MAC address of the peer to reconnect
+ * @param[in] attempt  The number of attempts made so far
+ * @param[in] elapsed_msec  The time elapsed since the peer was disconnected, in milliseconds. With #WIFI_DIRECT_RECONNECT_RECOVERED, this is the time to recover.
+ * @param[in] user_data  The user data passed from the callback registration function
+ * @see wifi_direct_set_auto_reconnect()
+ * @see wifi_direct_set_reconnect_state_changed_cb()
+ * @see wifi_direct_unset_reconnect_state_changed_cb()
+ */
+typedef void (*wifi_direct_reconnect_state_changed_cb) (wifi_direct_error_e error_code, wifi_direct_reconnect_state_e reconnect_state, const wifi_direct_mac_s* mac_address, int attempt, int elapsed_msec, void *user_data);
+
+/**
+ * @brief Called when a background scan window is finished.
+ * @remarks @a info is valid only in this function.
+ * @param[in] info  The result of the scan window
+ * @param[in] user_data  The user data passed from the callback registration function
+ * @see wifi_direct_start_background_discovery()
+ * @see wifi_direct_set_background_scan_window_cb()
+ * @see wifi_direct_unset_background_scan_window_cb()
+ */
+typedef void (*wifi_direct_background_scan_window_cb) (wifi_direct_scan_window_info_s* info, void *user_data);
+
 /**
  * @brief Initialize Wi-Fi Direct service.
  * @return 0 on success, otherwise a negative error value.
@@ -404,6 +656,60 @@ int wifi_direct_set_client_ip_address_assigned_cb(wifi_direct_client_ip_address_
  */
 int wifi_direct_unset_client_ip_address_assigned_cb(void);
 
+/**
+ * @brief Registers the callback called when the state of connection is changed, with the MAC address in binary form.
+ * @remarks This callback can be registered together with wifi_direct_connection_state_changed_cb(). In that case both are invoked.
+ * @param[in] cb  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_connection_state_changed_mac_cb()
+ * @see wifi_direct_connection_state_changed_mac_cb()
+ */
+int wifi_direct_set_connection_state_changed_mac_cb(wifi_direct_connection_state_changed_mac_cb cb, void* user_data);
+
+/**
+ * @brief Unregisters the callback called when the state of connection is changed, with the MAC address in binary form.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_connection_state_changed_mac_cb()
+ */
+int wifi_direct_unset_connection_state_changed_mac_cb(void);
+
+/**
+ * @brief Registers the callback called when IP address of client is assigned when your device is group owner, with the addresses in binary form.
+ * @remarks This callback can be registered together with wifi_direct_client_ip_address_assigned_cb(). In that case both are invoked.
+ * @param[in] cb  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_client_ip_address_assigned_mac_cb()
+ * @see wifi_direct_client_ip_address_assigned_mac_cb()
+ */
+int wifi_direct_set_client_ip_address_assigned_mac_cb(wifi_direct_client_ip_address_assigned_mac_cb cb, void* user_data);
+
+/**
+ * @brief Unregisters the callback called when IP address of client is assigned when your device is group owner, with the addresses in binary form.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_client_ip_address_assigned_mac_cb()
+ */
+int wifi_direct_unset_client_ip_address_assigned_mac_cb(void);
+
 /**
  * @brief Activates the Wi-Fi Direct service, asynchronous.
  * @return 0 on success, otherwise a negative error value.
@@ -529,6 +835,30 @@ int wifi_direct_foreach_discovered_peers(wifi_direct_discovered_peer_cb callback
  */
 int wifi_direct_connect(const char* mac_address);
 
+/**
+ * @brief Connects to a specified peer given by MAC address in binary form, asynchronous.
+ * @details This API works like wifi_direct_connect() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of remote device
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_TOO_MANY_CLIENT  Too many client
+ * @retval #WIFI_DIRECT_ERROR_CONNECTION_TIME_OUT  Connection timed out
+ * @retval #WIFI_DIRECT_ERROR_CONNECTION_FAILED  Connection failed
+ * @retval #WIFI_DIRECT_ERROR_AUTH_FAILED  Authentication failed
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @post wifi_direct_connection_state_changed_cb() will be invoked.
+ * @see wifi_direct_activate()
+ * @see wifi_direct_connect()
+ * @see wifi_direct_disconnect_mac()
+ * @see wifi_direct_connection_state_changed_mac_cb()
+ */
+int wifi_direct_connect_mac(const wifi_direct_mac_s* mac_address);
+
 /**
  * @brief Disconnects all connected links to peers, asynchronous.
  * @return 0 on success, otherwise a negative error value.
@@ -565,6 +895,27 @@ int wifi_direct_disconnect_all(void);
  */
 int wifi_direct_disconnect(const char* mac_address);
 
+/**
+ * @brief Disconnects the specified peer given by MAC address in binary form, asynchronous.
+ * @details This API works like wifi_direct_disconnect() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of remote device
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @post wifi_direct_connection_state_changed_cb() will be invoked.
+ * @see wifi_direct_activate()
+ * @see wifi_direct_disconnect()
+ * @see wifi_direct_connect_mac()
+ * @see wifi_direct_connection_state_changed_mac_cb()
+ */
+int wifi_direct_disconnect_mac(const wifi_direct_mac_s* mac_address);
+
 /**
  * @brief Called repeatedly when you get the information of connected peers.
  * @remarks @a peer is valid only in this function.
@@ -793,8 +1144,11 @@ int wifi_direct_get_gateway_address(char** gateway_address);
 int wifi_direct_get_mac_address(char** mac_address);
 
 /**
- * @brief Gets the state of Wi-Fi Direct service.
- * @param[out] state  The state of Wi-Fi Direct service
+ * @brief Gets SSID(Service Set Identifier) of local device into the given buffer.
+ * @details This API works like wifi_direct_get_ssid() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_SSID_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] ssid  The buffer to store the SSID
+ * @param[in] len  The size of @a ssid in bytes
  * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
@@ -805,12 +1159,16 @@ int wifi_direct_get_mac_address(char** mac_address);
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
  * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
  * @see wifi_direct_initialize()
+ * @see wifi_direct_get_ssid()
  */
-int wifi_direct_get_state(wifi_direct_state_e* state);
+int wifi_direct_get_ssid_r(char* ssid, size_t len);
 
 /**
- * @brief Checks whether this device is discoverable or not.
- * @param[out] discoverable  Indicats whether this device is discoverable or not
+ * @brief Gets the name of network interface into the given buffer.
+ * @details This API works like wifi_direct_get_network_interface_name() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_INTERFACE_NAME_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] name  The buffer to store the name of network interface
+ * @param[in] len  The size of @a name in bytes
  * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
@@ -819,14 +1177,18 @@ int wifi_direct_get_state(wifi_direct_state_e* state);
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_network_interface_name()
  */
-int wifi_direct_is_discoverable(bool* discoverable);
+int wifi_direct_get_network_interface_name_r(char* name, size_t len);
 
 /**
- * @brief Gets the primary device type of local device.
- * @param[out] type  The primary device type
+ * @brief Gets IP address of local device into the given buffer.
+ * @details This API works like wifi_direct_get_ip_address() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_IP_ADDRESS_STR_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] ip_address  The buffer to store the IP address
+ * @param[in] len  The size of @a ip_address in bytes
  * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
@@ -835,14 +1197,18 @@ int wifi_direct_is_discoverable(bool* discoverable);
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_ip_address()
  */
-int wifi_direct_get_primary_device_type(wifi_direct_primary_device_type_e* type);
+int wifi_direct_get_ip_address_r(char* ip_address, size_t len);
 
 /**
- * @brief Gets the secondary device type of local device.
- * @param[out] type  The secondary device type
+ * @brief Gets the Subnet Mask into the given buffer.
+ * @details This API works like wifi_direct_get_subnet_mask() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_IP_ADDRESS_STR_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] subnet_mask  The buffer to store the subnet mask
+ * @param[in] len  The size of @a subnet_mask in bytes
  * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
@@ -851,25 +1217,19 @@ int wifi_direct_get_primary_device_type(wifi_direct_primary_device_type_e* type)
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
- */
-int wifi_direct_get_secondary_device_type(wifi_direct_secondary_device_type_e* type);
-
-/**
- * @brief Called when you get the supported WPS(Wi-Fi Protected Setup) type repeatedly.
- * @param[in] type  The type of WPS
- * @param[in] user_data  The user data passed from the request function
- * @return  @c true to continue with the next iteration of the loop, \n @c false to break out of the loop
- * @pre  wifi_direct_foreach_supported_wps_types() will invoke this callback.
- * @see  wifi_direct_foreach_supported_wps_types()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_subnet_mask()
  */
-typedef bool(*wifi_direct_supported_wps_type_cb)(wifi_direct_wps_type_e type, void* user_data);
+int wifi_direct_get_subnet_mask_r(char* subnet_mask, size_t len);
 
 /**
- * @brief Gets the supported WPS(Wi-Fi Protected Setup) types.
- * @param[in] callback  The callback function to invoke
- * @param[in] user_data  The user data to be passed to the callback function
+ * @brief Gets the Gateway address into the given buffer.
+ * @details This API works like wifi_direct_get_gateway_address() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_IP_ADDRESS_STR_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] gateway_address  The buffer to store the gateway address
+ * @param[in] len  The size of @a gateway_address in bytes
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -877,15 +1237,19 @@ typedef bool(*wifi_direct_supported_wps_type_cb)(wifi_direct_wps_type_e type, vo
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
- * @see wifi_direct_supported_wps_type_cb()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_gateway_address()
  */
-int wifi_direct_foreach_supported_wps_types(wifi_direct_supported_wps_type_cb callback, void* user_data);
+int wifi_direct_get_gateway_address_r(char* gateway_address, size_t len);
 
 /**
- * @brief Sets the WPS(Wi-Fi Protected Setup) type.
- * @param[in] type  The type of WPS
+ * @brief Gets MAC address of local device into the given buffer.
+ * @details This API works like wifi_direct_get_mac_address() but stores the result in the buffer given by you instead of allocating memory.
+ * @remarks A buffer of #WIFI_DIRECT_MAC_ADDRESS_STR_LEN bytes is large enough. If @a len is too small to store the result, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[out] mac_address  The buffer to store the MAC address
+ * @param[in] len  The size of @a mac_address in bytes
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -895,13 +1259,14 @@ int wifi_direct_foreach_supported_wps_types(wifi_direct_supported_wps_type_cb ca
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
  * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
  * @see wifi_direct_initialize()
- * @see wifi_direct_foreach_supported_wps_types()
+ * @see wifi_direct_get_mac_address()
  */
-int wifi_direct_set_wps_type(wifi_direct_wps_type_e type);
+int wifi_direct_get_mac_address_r(char* mac_address, size_t len);
 
 /**
- * @brief Gets the WPS(Wi-Fi Protected Setup) type.
- * @param[out] type  The type of WPS
+ * @brief Gets IP address of local device in binary form.
+ * @param[out] ip_address  The IP address in network byte order
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -909,16 +1274,16 @@ int wifi_direct_set_wps_type(wifi_direct_wps_type_e type);
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
- * @see wifi_direct_foreach_supported_wps_types()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_ip_address()
  */
-int wifi_direct_get_wps_type(wifi_direct_wps_type_e* type);
+int wifi_direct_get_ip_address_in(struct in_addr* ip_address);
 
 /**
- * @brief Sets the intent of a group owner.
- * @remarks The range of intent is 0 ~ 15. The higher the @a intent is, the higher the probability to be group owner is.
- * @param[in] intent  The intent of a group owner
+ * @brief Gets the Subnet Mask in binary form.
+ * @param[out] subnet_mask  The subnet mask in network byte order
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -926,15 +1291,16 @@ int wifi_direct_get_wps_type(wifi_direct_wps_type_e* type);
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
- * @see wifi_direct_get_group_owner_intent()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_subnet_mask()
  */
-int wifi_direct_set_group_owner_intent(int intent);
+int wifi_direct_get_subnet_mask_in(struct in_addr* subnet_mask);
 
 /**
- * @brief Gets the intent of a group owner.
- * @param[out] intent  The intent of a group owner
+ * @brief Gets the Gateway address in binary form.
+ * @param[out] gateway_address  The gateway address in network byte order
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -942,15 +1308,16 @@ int wifi_direct_set_group_owner_intent(int intent);
  * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
  * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
- * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
- * @see wifi_direct_initialize()
- * @see wifi_direct_set_group_owner_intent()
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_gateway_address()
  */
-int wifi_direct_get_group_owner_intent(int* intent);
+int wifi_direct_get_gateway_address_in(struct in_addr* gateway_address);
 
 /**
- * @brief Sets the max number of clients.
- * @param[in] max  The max number of clients
+ * @brief Gets MAC address of local device in binary form.
+ * @param[out] mac_address  The MAC address
+ * @return 0 on success, otherwise a negative error value.
  * @retval #WIFI_DIRECT_ERROR_NONE  Successful
  * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
  * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
@@ -960,9 +1327,181 @@ int wifi_direct_get_group_owner_intent(int* intent);
  * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
  * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
  * @see wifi_direct_initialize()
- * @see wifi_direct_get_max_clients()
+ * @see wifi_direct_get_mac_address()
  */
-int wifi_direct_set_max_clients(int max);
+int wifi_direct_get_mac_address_raw(wifi_direct_mac_s* mac_address);
+
+/**
+ * @brief Gets the state of Wi-Fi Direct service.
+ * @param[out] state  The state of Wi-Fi Direct service
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ */
+int wifi_direct_get_state(wifi_direct_state_e* state);
+
+/**
+ * @brief Checks whether this device is discoverable or not.
+ * @param[out] discoverable  Indicats whether this device is discoverable or not
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ */
+int wifi_direct_is_discoverable(bool* discoverable);
+
+/**
+ * @brief Gets the primary device type of local device.
+ * @param[out] type  The primary device type
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ */
+int wifi_direct_get_primary_device_type(wifi_direct_primary_device_type_e* type);
+
+/**
+ * @brief Gets the secondary device type of local device.
+ * @param[out] type  The secondary device type
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ */
+int wifi_direct_get_secondary_device_type(wifi_direct_secondary_device_type_e* type);
+
+/**
+ * @brief Called when you get the supported WPS(Wi-Fi Protected Setup) type repeatedly.
+ * @param[in] type  The type of WPS
+ * @param[in] user_data  The user data passed from the request function
+ * @return  @c true to continue with the next iteration of the loop, \n @c false to break out of the loop
+ * @pre  wifi_direct_foreach_supported_wps_types() will invoke this callback.
+ * @see  wifi_direct_foreach_supported_wps_types()
+ */
+typedef bool(*wifi_direct_supported_wps_type_cb)(wifi_direct_wps_type_e type, void* user_data);
+
+/**
+ * @brief Gets the supported WPS(Wi-Fi Protected Setup) types.
+ * @param[in] callback  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_supported_wps_type_cb()
+ */
+int wifi_direct_foreach_supported_wps_types(wifi_direct_supported_wps_type_cb callback, void* user_data);
+
+/**
+ * @brief Sets the WPS(Wi-Fi Protected Setup) type.
+ * @param[in] type  The type of WPS
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_foreach_supported_wps_types()
+ */
+int wifi_direct_set_wps_type(wifi_direct_wps_type_e type);
+
+/**
+ * @brief Gets the WPS(Wi-Fi Protected Setup) type.
+ * @param[out] type  The type of WPS
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_foreach_supported_wps_types()
+ */
+int wifi_direct_get_wps_type(wifi_direct_wps_type_e* type);
+
+/**
+ * @brief Sets the intent of a group owner.
+ * @remarks The range of intent is 0 ~ 15. The higher the @a intent is, the higher the probability to be group owner is.
+ * @param[in] intent  The intent of a group owner
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_group_owner_intent()
+ */
+int wifi_direct_set_group_owner_intent(int intent);
+
+/**
+ * @brief Gets the intent of a group owner.
+ * @param[out] intent  The intent of a group owner
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_group_owner_intent()
+ */
+int wifi_direct_get_group_owner_intent(int* intent);
+
+/**
+ * @brief Sets the max number of clients.
+ * @param[in] max  The max number of clients
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_max_clients()
+ */
+int wifi_direct_set_max_clients(int max);
 
 /**
  * @brief Gets the max number of clients.
@@ -1013,6 +1552,1539 @@ int wifi_direct_get_own_group_channel(int* channel);
  */
 int wifi_direct_get_operating_channel(int* channel);
 
+/**
+ * @brief Called repeatedly when you get the score of candidate channels for own group.
+ * @remarks @a candidate is valid only in this function.
+ * @param[in] candidate The score of candidate channel
+ * @param[in] user_data The user data passed from foreach function
+ * @return @c true to continue with the next iteration of the loop, \n @c false to break out of the loop
+ * @see wifi_direct_foreach_channel_candidates()
+ */
+typedef bool(*wifi_direct_channel_candidate_cb)(wifi_direct_channel_candidate_info_s* candidate, void* user_data);
+
+/**
+ * @brief Gets the score of candidate channels for own group.
+ * @details Channels are scored from the channels of peers found by the most recent discovery and from the measured interference.
+ * Channels on which discovered peers are listening get a higher score, congested channels get a lower score.
+ * Candidates are passed in descending order of score.
+ * Only channels allowed as P2P operating channel by the current regulatory domain are candidates.
+ * If there is no discovery result, channels are scored from the measured interference only.
+ * If there is no interference measurement either, @a callback is not invoked.
+ * @param[in] callback  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_start_discovery()
+ * @see wifi_direct_channel_candidate_cb()
+ * @see wifi_direct_create_group_on_channel()
+ */
+int wifi_direct_foreach_channel_candidates(wifi_direct_channel_candidate_cb callback, void* user_data);
+
+/**
+ * @brief Creates a Wi-Fi Direct Group on the specified channel, asynchronous.
+ * @details This API works like wifi_direct_create_group() but the group is operated on @a channel.
+ * If @a channel is 0, the candidate channel with the highest score is used.
+ * If there is no candidate channel because neither discovery result nor interference measurement exists,
+ * the channel is selected in the same way as wifi_direct_create_group().
+ * @remarks @a channel is an IEEE 802.11 channel number, 1 ~ 14 in the 2.4 GHz band or 36 ~ 165 in the 5 GHz band.
+ * If @a channel is not allowed as P2P operating channel by the current regulatory domain, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[in] channel  The operating channel of the group, or 0 to select the best candidate channel
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @retval #WIFI_DIRECT_ERROR_AUTH_FAILED  Authentication failed
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @post wifi_direct_connection_state_changed_cb() will be invoked with WIFI_DIRECT_GROUP_CREATED.
+ * @see wifi_direct_activate()
+ * @see wifi_direct_create_group()
+ * @see wifi_direct_foreach_channel_candidates()
+ * @see wifi_direct_connection_state_changed_cb()
+ */
+int wifi_direct_create_group_on_channel(int channel);
+
+/**
+ * @brief Converts a MAC address string like "00:11:22:33:44:55" to binary form.
+ * @remarks Both upper and lower case hexadecimal digits are accepted. This API does not need Wi-Fi Direct service to be initialized.
+ * @param[in] str  The MAC address string
+ * @param[out] mac_address  The MAC address in binary form
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @see wifi_direct_mac_to_string()
+ */
+int wifi_direct_mac_from_string(const char* str, wifi_direct_mac_s* mac_address);
+
+/**
+ * @brief Converts a MAC address in binary form to a string like "00:11:22:33:44:55".
+ * @remarks The string is formatted with lower case hexadecimal digits. This API does not need Wi-Fi Direct service to be initialized.
+ * @param[in] mac_address  The MAC address in binary form
+ * @param[out] str  The buffer to store the MAC address string
+ * @param[in] len  The size of @a str in bytes. It must be at least #WIFI_DIRECT_MAC_ADDRESS_STR_LEN.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @see wifi_direct_mac_from_string()
+ */
+int wifi_direct_mac_to_string(const wifi_direct_mac_s* mac_address, char* str, size_t len);
+
+/**
+ * @brief Sets the coalescing window of discovery events.
+ * @details The first #WIFI_DIRECT_DISCOVERY_FOUND event is delivered immediately and opens a window of @a msec.
+ * Further #WIFI_DIRECT_DISCOVERY_FOUND events received within the window are merged,
+ * and wifi_direct_discovery_state_chagned_cb() is invoked once more at the end of the window if any were received.
+ * The next #WIFI_DIRECT_DISCOVERY_FOUND after the window is again delivered immediately.
+ * All peers found during the window can be got by wifi_direct_foreach_discovered_peers().
+ * Other discovery states are delivered immediately, and any pending #WIFI_DIRECT_DISCOVERY_FOUND is delivered before them.
+ * @remarks The default is 0, which means that every event is delivered.
+ * @param[in] msec  The coalescing window in milliseconds, 0 to disable coalescing
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_discovery_coalescing_window()
+ * @see wifi_direct_get_event_stats()
+ */
+int wifi_direct_set_discovery_coalescing_window(int msec);
+
+/**
+ * @brief Gets the coalescing window of discovery events.
+ * @param[out] msec  The coalescing window in milliseconds
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_discovery_coalescing_window()
+ */
+int wifi_direct_get_discovery_coalescing_window(int* msec);
+
+/**
+ * @brief Sets the hysteresis of connection state events.
+ * @details When a peer is disconnected by #WIFI_DIRECT_DISASSOCIATION_IND or #WIFI_DIRECT_DISCONNECTION_IND,
+ * the event is held for @a msec. If the same peer is connected again by #WIFI_DIRECT_CONNECTION_RSP within that time,
+ * both events are dropped and wifi_direct_connection_state_changed_cb() is not invoked.
+ * While the disconnection is held, #WIFI_DIRECT_CONNECTION_REQ, #WIFI_DIRECT_CONNECTION_WPS_REQ and
+ * #WIFI_DIRECT_CONNECTION_IN_PROGRESS for the same peer are held after it. They are dropped together with it
+ * if the peer is connected again, and all dropped events are counted in connection_state_dropped of #wifi_direct_event_stats_s.
+ * Otherwise the held events are delivered in order, starting with the disconnection, at the end of the hysteresis.
+ * A held #WIFI_DIRECT_CONNECTION_WPS_REQ which needs an answer from the application ends the hysteresis at once.
+ * @remarks The default is 0, which means that every event is delivered immediately.
+ * @param[in] msec  The hysteresis in milliseconds, 0 to disable it
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_connection_state_hysteresis()
+ * @see wifi_direct_get_event_stats()
+ */
+int wifi_direct_set_connection_state_hysteresis(int msec);
+
+/**
+ * @brief Gets the hysteresis of connection state events.
+ * @param[out] msec  The hysteresis in milliseconds
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_connection_state_hysteresis()
+ */
+int wifi_direct_get_connection_state_hysteresis(int* msec);
+
+/**
+ * @brief Gets the statistics of event delivery since wifi_direct_initialize() or wifi_direct_reset_event_stats().
+ * @param[out] stats  The statistics of event delivery
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_reset_event_stats()
+ */
+int wifi_direct_get_event_stats(wifi_direct_event_stats_s* stats);
+
+/**
+ * @brief Resets the statistics of event delivery.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_event_stats()
+ */
+int wifi_direct_reset_event_stats(void);
+
+/**
+ * @brief Enables or disables automatic reconnection.
+ * @details If enabled, a peer is reconnected automatically when the link to it is lost by the remote side,
+ * i.e. #WIFI_DIRECT_DISCONNECTION_IND, or #WIFI_DIRECT_GROUP_DESTROYED caused by the remote Group Owner.
+ * Attempts are spaced by exponential backoff with random jitter, set by wifi_direct_set_reconnect_backoff().
+ * Each attempt first scans only the last known channel of the peer and looks for its last known interface address,
+ * and falls back to a full discovery only if the peer is not found there.
+ * Reconnection is run by the Wi-Fi Direct service, not by the application. It is enabled while at least one application enables it,
+ * and the service runs a single backoff loop per peer however many applications enable it.
+ * Every application which registered wifi_direct_reconnect_state_changed_cb() is notified of that loop.
+ * Teardown initiated by local device never starts reconnection. This includes wifi_direct_disconnect(), wifi_direct_disconnect_all(),
+ * wifi_direct_destroy_group() and wifi_direct_deactivate(), and also cancels reconnection in progress.
+ * wifi_direct_deinitialize() withdraws only the enabling of the calling application.
+ * If #WIFI_DIRECT_DISCONNECTION_IND is held by the hysteresis set by wifi_direct_set_connection_state_hysteresis(),
+ * reconnection does not start until the longest hysteresis of the applications which enabled it has passed.
+ * If the peer is connected again within that time, reconnection does not start at all.
+ * When reconnection starts after such a hysteresis, @a elapsed_msec of wifi_direct_reconnect_state_changed_cb() is measured from the disconnection, including the hysteresis.
+ * @remarks Automatic reconnection is disabled by default. The enabling of an application is removed by wifi_direct_deinitialize() or when the application exits.
+ * @param[in] enable  @c true to enable automatic reconnection, \n @c false to disable it
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_is_auto_reconnect_enabled()
+ * @see wifi_direct_set_reconnect_backoff()
+ * @see wifi_direct_reconnect_state_changed_cb()
+ */
+int wifi_direct_set_auto_reconnect(bool enable);
+
+/**
+ * @brief Checks whether automatic reconnection is enabled or not.
+ * @param[out] enabled  Indicates whether automatic reconnection is enabled or not
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_auto_reconnect()
+ */
+int wifi_direct_is_auto_reconnect_enabled(bool* enabled);
+
+/**
+ * @brief Sets the backoff of automatic reconnection.
+ * @details The n-th attempt is made after a random delay between half and all of min(@a initial_msec * 2^(n-1), @a max_msec),
+ * so the first attempt is made between @a initial_msec / 2 and @a initial_msec after reconnection starts.
+ * @remarks The backoff is shared by all applications, since the Wi-Fi Direct service runs one backoff loop per peer.
+ * The last value set by any application is used, and it is reset to the default when the Wi-Fi Direct service restarts.
+ * @param[in] initial_msec  The base delay of the first attempt, in milliseconds
+ * @param[in] max_msec  The upper bound of the delay between attempts, in milliseconds
+ * @param[in] max_attempts  The maximum number of attempts, 0 for no limit
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_reconnect_backoff()
+ * @see wifi_direct_set_auto_reconnect()
+ */
+int wifi_direct_set_reconnect_backoff(int initial_msec, int max_msec, int max_attempts);
+
+/**
+ * @brief Gets the backoff of automatic reconnection.
+ * @param[out] initial_msec  The base delay of the first attempt, in milliseconds
+ * @param[out] max_msec  The upper bound of the delay between attempts, in milliseconds
+ * @param[out] max_attempts  The maximum number of attempts, 0 for no limit
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_reconnect_backoff()
+ */
+int wifi_direct_get_reconnect_backoff(int* initial_msec, int* max_msec, int* max_attempts);
+
+/**
+ * @brief Cancels automatic reconnection of a peer in progress.
+ * @details The backoff loop of the peer is shared by all applications, so it is canceled for all of them,
+ * and every application which registered wifi_direct_reconnect_state_changed_cb() is notified with #WIFI_DIRECT_RECONNECT_CANCELED.
+ * @param[in] mac_address  The MAC address of the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @post wifi_direct_reconnect_state_changed_cb() will be invoked with #WIFI_DIRECT_RECONNECT_CANCELED.
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_cancel_reconnect_mac()
+ * @see wifi_direct_cancel_all_reconnects()
+ * @see wifi_direct_set_auto_reconnect()
+ */
+int wifi_direct_cancel_reconnect(const char* mac_address);
+
+/**
+ * @brief Cancels automatic reconnection of a peer given by MAC address in binary form in progress.
+ * @details This API works like wifi_direct_cancel_reconnect() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @post wifi_direct_reconnect_state_changed_cb() will be invoked with #WIFI_DIRECT_RECONNECT_CANCELED.
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_cancel_reconnect()
+ */
+int wifi_direct_cancel_reconnect_mac(const wifi_direct_mac_s* mac_address);
+
+/**
+ * @brief Cancels automatic reconnection of all peers in progress.
+ * @details Like wifi_direct_cancel_reconnect(), this cancels the backoff loops for all applications.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @post wifi_direct_reconnect_state_changed_cb() will be invoked with #WIFI_DIRECT_RECONNECT_CANCELED for each peer.
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_cancel_reconnect()
+ */
+int wifi_direct_cancel_all_reconnects(void);
+
+/**
+ * @brief Registers the callback called when the state of automatic reconnection is changed.
+ * @param[in] cb  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_reconnect_state_changed_cb()
+ * @see wifi_direct_reconnect_state_changed_cb()
+ */
+int wifi_direct_set_reconnect_state_changed_cb(wifi_direct_reconnect_state_changed_cb cb, void* user_data);
+
+/**
+ * @brief Unregisters the callback called when the state of automatic reconnection is changed.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_reconnect_state_changed_cb()
+ */
+int wifi_direct_unset_reconnect_state_changed_cb(void);
+
+/**
+ * @brief Gets the device type of a discovered peer.
+ * @remarks This API does not need Wi-Fi Direct service to be initialized.
+ * @param[in] peer  The discovered peer
+ * @return The pair of primary and secondary device type of @a peer
+ * @see wifi_direct_get_device_type_name()
+ * @see wifi_direct_get_device_type_traits()
+ */
+static inline wifi_direct_device_type_s wifi_direct_get_peer_device_type(const wifi_direct_discovered_peer_info_s* peer)
+{
+    wifi_direct_device_type_s type;
+
+    type.primary = peer->primary_device_type;
+    type.secondary = peer->secondary_device_type;
+    return type;
+}
+
+/**
+ * @brief Gets the index of a device type in the tables of wifi_direct_get_device_type_name() and wifi_direct_get_device_type_traits().
+ * @remarks An unknown primary device type maps to the row of #WIFI_DIRECT_PRIMARY_DEVICE_TYPE_OTHER,
+ * and an unknown secondary device type maps to the first column, which describes the primary device type.
+ * Both are done with masks, so this API has no branch.
+ * @param[in] key  The key made by #WIFI_DIRECT_DEVICE_TYPE_KEY
+ * @return The index of the device type, 0 ~ 119
+ */
+static inline unsigned int wifi_direct_get_device_type_index(int key)
+{
+    unsigned int primary = ((unsigned int)key >> 8) & 0xff;
+    unsigned int secondary = (unsigned int)key & 0xff;
+
+    primary &= -(unsigned int)(primary - 1 < 11);
+    secondary &= -(unsigned int)(secondary < 10);
+    return primary * 10 + secondary;
+}
+
+/**
+ * @brief Gets the name of a device type.
+ * @details The name is like "Computer - PC".
+ * If @a type is not a known pair, the name of its primary device type is returned.
+ * @remarks The name is looked up from a constant table, so this API needs no call into the Wi-Fi Direct library
+ * and does not need Wi-Fi Direct service to be initialized. The returned string is static. You must not release it.
+ * @param[in] type  The device type
+ * @return The name of the device type
+ * @see wifi_direct_get_device_type_traits()
+ * @see wifi_direct_get_peer_device_type()
+ */
+static inline const char* wifi_direct_get_device_type_name(wifi_direct_device_type_s type)
+{
+    static const char* const names[12 * 10] = {
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_OTHER */
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        "Other",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_COMPUTER */
+        "Computer",
+        "Computer - PC",
+        "Computer - Server",
+        "Computer - Media Center",
+        "Computer - UMPC",
+        "Computer - Notebook",
+        "Computer - Desktop",
+        "Computer - MID",
+        "Computer - Netbook",
+        "Computer",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_INPUT_DEVICE */
+        "Input device",
+        "Input device - Keyboard",
+        "Input device - Mouse",
+        "Input device - Joystick",
+        "Input device - Trackball",
+        "Input device - Controller",
+        "Input device - Remote",
+        "Input device - Touchscreen",
+        "Input device - Biometric reader",
+        "Input device - Barcode reader",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_PRINTER */
+        "Printer",
+        "Printer - Printer",
+        "Printer - Scanner",
+        "Printer - Fax",
+        "Printer - Copier",
+        "Printer - All-in-one",
+        "Printer",
+        "Printer",
+        "Printer",
+        "Printer",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_CAMERA */
+        "Camera",
+        "Camera - Digital still camera",
+        "Camera - Video camera",
+        "Camera - Webcam",
+        "Camera - Security camera",
+        "Camera",
+        "Camera",
+        "Camera",
+        "Camera",
+        "Camera",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_STORAGE */
+        "Storage",
+        "Storage - NAS",
+        "Storage",
+        "Storage",
+        "Storage",
+        "Storage",
+        "Storage",
+        "Storage",
+        "Storage",
+        "Storage",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_NETWORK_INFRA */
+        "Network infrastructure",
+        "Network infrastructure - AP",
+        "Network infrastructure - Router",
+        "Network infrastructure - Switch",
+        "Network infrastructure - Gateway",
+        "Network infrastructure",
+        "Network infrastructure",
+        "Network infrastructure",
+        "Network infrastructure",
+        "Network infrastructure",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_DISPLAY */
+        "Display",
+        "Display - TV",
+        "Display - Picture frame",
+        "Display - Projector",
+        "Display - Monitor",
+        "Display",
+        "Display",
+        "Display",
+        "Display",
+        "Display",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_MULTIMEDIA_DEVICE */
+        "Multimedia device",
+        "Multimedia device - DAR",
+        "Multimedia device - PVR",
+        "Multimedia device - MCX",
+        "Multimedia device - Set-top box",
+        "Multimedia device - Media Server / Media Adapter / Media Extender",
+        "Multimedia device - Portable video player",
+        "Multimedia device",
+        "Multimedia device",
+        "Multimedia device",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_GAME_DEVICE */
+        "Game device",
+        "Game device - Xbox",
+        "Game device - Xbox 360",
+        "Game device - Playstation",
+        "Game device - Console",
+        "Game device - Portable",
+        "Game device",
+        "Game device",
+        "Game device",
+        "Game device",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_TELEPHONE */
+        "Telephone",
+        "Telephone - Windows Mobile",
+        "Telephone - Phone - single mode",
+        "Telephone - Phone - dual mode",
+        "Telephone - Smart Phone - single mode",
+        "Telephone - Smart Phone - dual mode",
+        "Telephone",
+        "Telephone",
+        "Telephone",
+        "Telephone",
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_AUDIO */
+        "Audio",
+        "Audio - Tuner",
+        "Audio - Speaker",
+        "Audio - Portable Music Player",
+        "Audio - Headset",
+        "Audio - Headphone",
+        "Audio - Microphone",
+        "Audio",
+        "Audio",
+        "Audio",
+    };
+
+    return names[wifi_direct_get_device_type_index(WIFI_DIRECT_DEVICE_TYPE_KEY(type.primary, type.secondary))];
+}
+
+/**
+ * @brief Gets the traits of a device type.
+ * @details If @a type is not a known pair, the traits of its primary device type are returned.
+ * @remarks WPS traits describe what is usual for the device type. The WPS types a peer actually supports are given by @a supported_wps_types of #wifi_direct_discovered_peer_info_s.
+ * The traits are looked up from a constant table, so this API needs no call into the Wi-Fi Direct library
+ * and does not need Wi-Fi Direct service to be initialized.
+ * @param[in] type  The device type
+ * @return The traits of the device type.\n The OR operation on #wifi_direct_device_trait_e is returned like #WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | #WIFI_DIRECT_DEVICE_TRAIT_AUDIO
+ * @see wifi_direct_get_device_type_name()
+ * @see wifi_direct_get_peer_device_type()
+ */
+static inline int wifi_direct_get_device_type_traits(wifi_direct_device_type_s type)
+{
+    static const unsigned short traits[12 * 10] = {
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_OTHER */
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        WIFI_DIRECT_DEVICE_TRAIT_NONE,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_COMPUTER */
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_INPUT_DEVICE */
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_PRINTER */
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_PRINT | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_CAMERA */
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_CAPTURE | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_STORAGE */
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_NETWORK_INFRA */
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_NETWORK | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_DISPLAY */
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_MULTIMEDIA_DEVICE */
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_STORAGE | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_GAME_DEVICE */
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_TELEPHONE */
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        WIFI_DIRECT_DEVICE_TRAIT_INPUT | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_KEYPAD,
+        /* WIFI_DIRECT_PRIMARY_DEVICE_TYPE_AUDIO */
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_DISPLAY | WIFI_DIRECT_DEVICE_TRAIT_PORTABLE | WIFI_DIRECT_DEVICE_TRAIT_WPS_PIN_DISPLAY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+        WIFI_DIRECT_DEVICE_TRAIT_AUDIO | WIFI_DIRECT_DEVICE_TRAIT_WPS_PBC_ONLY,
+    };
+
+    return traits[wifi_direct_get_device_type_index(WIFI_DIRECT_DEVICE_TYPE_KEY(type.primary, type.secondary))];
+}
+
+/**
+ * @brief Sets the provisioning profile of a peer.
+ * @details When the peer requests WPS, the Wi-Fi Direct service answers it immediately with @a type and @a pin,
+ * and wifi_direct_connection_state_changed_cb() is not invoked with #WIFI_DIRECT_CONNECTION_WPS_REQ.
+ * The profile of a peer has priority over the profile of its device type set by wifi_direct_set_provisioning_profile_by_device_type().
+ * If no profile matches, the type set by wifi_direct_set_wps_type() is used as before.
+ * The profile belongs to the calling application. It is removed by wifi_direct_deinitialize() or when the application exits, and is not persisted.
+ * If several applications set a profile for the same peer, the one set last is used.
+ * @remarks P2P Device Addresses are broadcast in probe responses and can be spoofed by any nearby device, so a profile must not accept a peer by its MAC address alone.
+ * Only a PIN type can be used, so that a peer must still know the PIN to connect.
+ * If @a type is #WIFI_DIRECT_WPS_TYPE_PBC or @a pin is NULL, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * If @a pin has 8 digits, the last digit must be the WPS checksum digit of the first 7 digits. Otherwise #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[in] mac_address  The MAC address of the peer
+ * @param[in] type  The WPS type to use with the peer, #WIFI_DIRECT_WPS_TYPE_PIN_DISPLAY or #WIFI_DIRECT_WPS_TYPE_PIN_KEYPAD
+ * @param[in] pin  The PIN of 4 or 8 digits to use with the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile_mac()
+ * @see wifi_direct_unset_provisioning_profile()
+ * @see wifi_direct_set_provisioning_profile_by_device_type()
+ */
+int wifi_direct_set_provisioning_profile(const char* mac_address, wifi_direct_wps_type_e type, const char* pin);
+
+/**
+ * @brief Sets the provisioning profile of a peer given by MAC address in binary form.
+ * @details This API works like wifi_direct_set_provisioning_profile() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of the peer
+ * @param[in] type  The WPS type to use with the peer, #WIFI_DIRECT_WPS_TYPE_PIN_DISPLAY or #WIFI_DIRECT_WPS_TYPE_PIN_KEYPAD
+ * @param[in] pin  The PIN of 4 or 8 digits to use with the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile()
+ * @see wifi_direct_unset_provisioning_profile_mac()
+ */
+int wifi_direct_set_provisioning_profile_mac(const wifi_direct_mac_s* mac_address, wifi_direct_wps_type_e type, const char* pin);
+
+/**
+ * @brief Removes the provisioning profile of a peer.
+ * @details Only the profile set by the calling application is removed.
+ * @param[in] mac_address  The MAC address of the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile()
+ */
+int wifi_direct_unset_provisioning_profile(const char* mac_address);
+
+/**
+ * @brief Removes the provisioning profile of a peer given by MAC address in binary form.
+ * @details This API works like wifi_direct_unset_provisioning_profile() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of the peer
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile_mac()
+ */
+int wifi_direct_unset_provisioning_profile_mac(const wifi_direct_mac_s* mac_address);
+
+/**
+ * @brief Sets the provisioning profile of a primary device type.
+ * @details This API works like wifi_direct_set_provisioning_profile() for every peer of @a primary_device_type
+ * which has no provisioning profile of its own.
+ * Like that, the profile belongs to the calling application and is removed by wifi_direct_deinitialize() or when the application exits.
+ * @remarks Peers choose the primary device type they advertise, so any nearby device can match this profile.
+ * Only a PIN type can be used, so that a peer must still know the PIN to connect.
+ * If @a type is #WIFI_DIRECT_WPS_TYPE_PBC or @a pin is NULL, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * If @a pin has 8 digits, the last digit must be the WPS checksum digit of the first 7 digits. Otherwise #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[in] primary_device_type  The primary device type of peers
+ * @param[in] type  The WPS type to use with the peers, #WIFI_DIRECT_WPS_TYPE_PIN_DISPLAY or #WIFI_DIRECT_WPS_TYPE_PIN_KEYPAD
+ * @param[in] pin  The PIN of 4 or 8 digits to use with the peers
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_provisioning_profile_by_device_type()
+ * @see wifi_direct_set_provisioning_profile()
+ */
+int wifi_direct_set_provisioning_profile_by_device_type(wifi_direct_primary_device_type_e primary_device_type, wifi_direct_wps_type_e type, const char* pin);
+
+/**
+ * @brief Removes the provisioning profile of a primary device type.
+ * @param[in] primary_device_type  The primary device type of peers
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile_by_device_type()
+ */
+int wifi_direct_unset_provisioning_profile_by_device_type(wifi_direct_primary_device_type_e primary_device_type);
+
+/**
+ * @brief Removes all provisioning profiles.
+ * @details Only the profiles set by the calling application are removed.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_provisioning_profile()
+ * @see wifi_direct_set_provisioning_profile_by_device_type()
+ */
+int wifi_direct_clear_provisioning_profiles(void);
+
+/**
+ * @brief Opens the peer table shared by the Wi-Fi Direct service.
+ * @details The Wi-Fi Direct service publishes discovered and connected peers in a read-only shared memory table.
+ * Reading the table does not communicate with the Wi-Fi Direct service, so several processes can read it at the same time
+ * without calling wifi_direct_initialize().
+ * Since the Wi-Fi Direct service does not check the caller, access is controlled by the permissions of the shared memory object instead.
+ * It is owned by the Wi-Fi Direct service with mode 0640, and its group is the group of processes which are permitted to use the Wi-Fi Direct service.
+ * Other processes cannot map it, and #WIFI_DIRECT_ERROR_NOT_PERMITTED is returned to them.
+ * @remarks @a table must be released with wifi_direct_peer_table_close() by you.
+ * @param[out] table  The handle of the peer table
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OUT_OF_MEMORY  Out of memory
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  The calling process is not permitted to read the peer table
+ * @see wifi_direct_peer_table_close()
+ */
+int wifi_direct_peer_table_open(wifi_direct_peer_table_h* table);
+
+/**
+ * @brief Closes the peer table.
+ * @param[in] table  The handle of the peer table
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ */
+int wifi_direct_peer_table_close(wifi_direct_peer_table_h table);
+
+/**
+ * @brief Gets the information of discovered peers from the peer table.
+ * @details The peers are read from a consistent snapshot of the table.
+ * If the table is updated while it is read, reading is retried before @a callback is invoked.
+ * Stale peers from peer history are included with @a is_stale set to @c true only if they are made visible on @a table
+ * by wifi_direct_peer_table_set_stale_peers_visible().
+ * @param[in] table  The handle of the peer table
+ * @param[in] callback  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OUT_OF_MEMORY  Out of memory
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ * @see wifi_direct_foreach_discovered_peers()
+ * @see wifi_direct_discovered_peer_cb()
+ */
+int wifi_direct_peer_table_foreach_discovered_peers(wifi_direct_peer_table_h table, wifi_direct_discovered_peer_cb callback, void* user_data);
+
+/**
+ * @brief Gets the information of connected peers from the peer table.
+ * @details The peers are read from a consistent snapshot of the table.
+ * If the table is updated while it is read, reading is retried before @a callback is invoked.
+ * @param[in] table  The handle of the peer table
+ * @param[in] callback  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OUT_OF_MEMORY  Out of memory
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ * @see wifi_direct_foreach_connected_peers()
+ * @see wifi_direct_connected_peer_cb()
+ */
+int wifi_direct_peer_table_foreach_connected_peers(wifi_direct_peer_table_h table, wifi_direct_connected_peer_cb callback, void* user_data);
+
+/**
+ * @brief Gets the generation of the peer table.
+ * @details The generation is increased whenever the Wi-Fi Direct service updates the table.
+ * If the generation is not changed, the peers are not changed either.
+ * @param[in] table  The handle of the peer table
+ * @param[out] generation  The generation of the peer table
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ */
+int wifi_direct_peer_table_get_generation(wifi_direct_peer_table_h table, unsigned int* generation);
+
+/**
+ * @brief Waits until the peer table is updated.
+ * @details This API returns when the generation of the table differs from @a generation, or when @a timeout_msec elapses.
+ * Waiting is done on the generation word in the shared memory by futex, and the Wi-Fi Direct service wakes all waiters when it updates the table.
+ * Every process waiting on the table is woken, so one reader never hides an update from another.
+ * If the generation already differs from @a generation, this API returns immediately.
+ * @remarks Pass the generation got by wifi_direct_peer_table_get_generation() before reading the table, so that no update is missed.
+ * @param[in] table  The handle of the peer table
+ * @param[in] generation  The generation last seen by you
+ * @param[in] timeout_msec  The maximum time to wait, in milliseconds. If -1, waits without limit.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_CONNECTION_TIME_OUT  @a timeout_msec elapsed without update
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ * @see wifi_direct_peer_table_get_generation()
+ */
+int wifi_direct_peer_table_wait(wifi_direct_peer_table_h table, unsigned int generation, int timeout_msec);
+
+/**
+ * @brief Starts discovery in background while connected, asynchronous.
+ * @details Unlike wifi_direct_start_discovery(), this API keeps the group running.
+ * Short Listen and Search windows are interleaved with group traffic so that they use at most @a airtime_percent of the airtime.
+ * The state of Wi-Fi Direct service stays #WIFI_DIRECT_STATE_CONNECTED.
+ * wifi_direct_discovery_state_chagned_cb() is invoked with #WIFI_DIRECT_DISCOVERY_STARTED once when the first window starts,
+ * with #WIFI_DIRECT_DISCOVERY_FOUND when peers are found, and with #WIFI_DIRECT_DISCOVERY_FINISHED once when @a timeout elapses
+ * or wifi_direct_cancel_background_discovery() is called. They are not invoked for each window.
+ * The result of each window is notified by wifi_direct_background_scan_window_cb().
+ * @param[in] airtime_percent  The airtime budget for scanning, 1 ~ 50 percent
+ * @param[in] window_msec  The duration of each scan window, in milliseconds. If 0, a default value will be used.
+ * @param[in] timeout  Specifies the duration of discovery period, in seconds. If 0, discovery continues until wifi_direct_cancel_background_discovery() is called.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre The state of Wi-Fi Direct service must be #WIFI_DIRECT_STATE_CONNECTED.
+ * @post wifi_direct_discovery_state_chagned_cb() will be invoked.
+ * @see wifi_direct_get_state()
+ * @see wifi_direct_cancel_background_discovery()
+ * @see wifi_direct_background_scan_window_cb()
+ */
+int wifi_direct_start_background_discovery(int airtime_percent, int window_msec, int timeout);
+
+/**
+ * @brief Cancels discovery in background, asynchronous.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Discovery in background must be started by wifi_direct_start_background_discovery().
+ * @post wifi_direct_discovery_state_chagned_cb() will be invoked with #WIFI_DIRECT_DISCOVERY_FINISHED.
+ * @see wifi_direct_start_background_discovery()
+ */
+int wifi_direct_cancel_background_discovery(void);
+
+/**
+ * @brief Registers the callback called when a background scan window is finished.
+ * @param[in] cb  The callback function to invoke
+ * @param[in] user_data  The user data to be passed to the callback function
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_background_scan_window_cb()
+ * @see wifi_direct_background_scan_window_cb()
+ */
+int wifi_direct_set_background_scan_window_cb(wifi_direct_background_scan_window_cb cb, void* user_data);
+
+/**
+ * @brief Unregisters the callback called when a background scan window is finished.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_background_scan_window_cb()
+ */
+int wifi_direct_unset_background_scan_window_cb(void);
+
+/**
+ * @brief Enables or disables IP address allocation in EAPOL-Key frames.
+ * @details If enabled, the IP address is allocated during the group formation as allowed by the P2P specification,
+ * and DHCP is skipped when the peer supports it. Otherwise DHCP is used as before.
+ * @remarks It is disabled by default. The setting is applied to groups formed after this call.
+ * @param[in] enable  @c true to enable IP address allocation in EAPOL-Key frames, \n @c false to disable it
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_is_eapol_ip_allocation_enabled()
+ * @see wifi_direct_set_ip_address_pool()
+ */
+int wifi_direct_set_eapol_ip_allocation(bool enable);
+
+/**
+ * @brief Checks whether IP address allocation in EAPOL-Key frames is enabled or not.
+ * @param[out] enabled  Indicates whether IP address allocation in EAPOL-Key frames is enabled or not
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_eapol_ip_allocation()
+ */
+int wifi_direct_is_eapol_ip_allocation_enabled(bool* enabled);
+
+/**
+ * @brief Sets the IP address of group owner and the static pool of IP addresses assigned to clients when your device is group owner.
+ * @details The pool is used both for allocation in EAPOL-Key frames and by the DHCP server.
+ * @remarks The setting is applied to groups created after this call.
+ * @a start and @a end must be in the subnet of @a group_owner given by @a subnet_mask, @a start must not be greater than @a end,
+ * and @a group_owner must not be in the pool. Otherwise #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[in] group_owner  The IP address of your device as group owner in network byte order
+ * @param[in] start  The first IP address of the pool in network byte order
+ * @param[in] end  The last IP address of the pool in network byte order
+ * @param[in] subnet_mask  The subnet mask in network byte order
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_unset_ip_address_pool()
+ * @see wifi_direct_set_eapol_ip_allocation()
+ */
+int wifi_direct_set_ip_address_pool(const struct in_addr* group_owner, const struct in_addr* start, const struct in_addr* end, const struct in_addr* subnet_mask);
+
+/**
+ * @brief Restores the default IP address of group owner and the default pool of IP addresses assigned to clients.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_ip_address_pool()
+ */
+int wifi_direct_unset_ip_address_pool(void);
+
+/**
+ * @brief Gets the timestamps of IP address assignment of a connected peer.
+ * @details When your device is group owner, @a mac_address is the address of a client.
+ * Otherwise it is the address of the group owner and the timestamps are those of your device.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] timing  The timestamps of IP address assignment
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_ip_assignment_timing_mac()
+ * @see wifi_direct_client_ip_address_assigned_cb()
+ */
+int wifi_direct_get_ip_assignment_timing(const char* mac_address, wifi_direct_ip_assignment_timing_s* timing);
+
+/**
+ * @brief Gets the timestamps of IP address assignment of a connected peer given by MAC address in binary form.
+ * @details This API works like wifi_direct_get_ip_assignment_timing() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] timing  The timestamps of IP address assignment
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_ip_assignment_timing()
+ * @see wifi_direct_client_ip_address_assigned_mac_cb()
+ */
+int wifi_direct_get_ip_assignment_timing_mac(const wifi_direct_mac_s* mac_address, wifi_direct_ip_assignment_timing_s* timing);
+
+/**
+ * @brief Enables or disables peer history.
+ * @details If enabled, the Wi-Fi Direct service records discovered peers, with their MAC address, interface address, channel,
+ * device types and last seen time, in an append-only log which is compacted periodically.
+ * The history is loaded when the Wi-Fi Direct service starts, and immediately when it is enabled by this API.
+ * Peers in the history are given only to applications which opted in by wifi_direct_set_stale_peers_visible(),
+ * and to readers of the peer table which opted in by wifi_direct_peer_table_set_stale_peers_visible().
+ * @remarks The setting is shared by all applications and is kept across restart of the Wi-Fi Direct service and reboot.
+ * Peer history is disabled by default. Disabling it removes the recorded history.
+ * @param[in] enable  @c true to enable peer history, \n @c false to disable it
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_is_peer_history_enabled()
+ * @see wifi_direct_set_stale_peers_visible()
+ */
+int wifi_direct_set_peer_history(bool enable);
+
+/**
+ * @brief Sets whether stale peers from peer history are given to your application.
+ * @details If @a visible is @c true, peers in the history are given by wifi_direct_foreach_discovered_peers() with @a is_stale set to @c true
+ * until they are found by discovery or confirmed by wifi_direct_confirm_stale_peers(),
+ * so the list of peers is available right after this call, before the first discovery is finished.
+ * Applications which did not opt in never get stale peers from wifi_direct_foreach_discovered_peers().
+ * The peer table read without wifi_direct_initialize() has its own opt-in, wifi_direct_peer_table_set_stale_peers_visible().
+ * @remarks The setting applies only to your application and is reset by wifi_direct_deinitialize(). It is @c false by default.
+ * Stale peers must not be passed to wifi_direct_connect() before they are confirmed.
+ * @param[in] visible  @c true to get stale peers, \n @c false not to get them
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_peer_history()
+ * @see wifi_direct_confirm_stale_peers()
+ * @see wifi_direct_peer_table_set_stale_peers_visible()
+ */
+int wifi_direct_set_stale_peers_visible(bool visible);
+
+/**
+ * @brief Sets whether stale peers from peer history are given by a peer table handle.
+ * @details If @a visible is @c true, wifi_direct_peer_table_foreach_discovered_peers() gives peers in the history with @a is_stale set to @c true,
+ * like wifi_direct_set_stale_peers_visible() does for wifi_direct_foreach_discovered_peers().
+ * Handles which did not opt in never get stale peers.
+ * @remarks The setting applies only to @a table and is @c false when it is opened.
+ * Stale peers must not be passed to wifi_direct_connect() before they are confirmed.
+ * @param[in] table  The handle of the peer table
+ * @param[in] visible  @c true to get stale peers, \n @c false not to get them
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @pre @a table must be opened by wifi_direct_peer_table_open().
+ * @see wifi_direct_peer_table_open()
+ * @see wifi_direct_peer_table_foreach_discovered_peers()
+ * @see wifi_direct_set_stale_peers_visible()
+ */
+int wifi_direct_peer_table_set_stale_peers_visible(wifi_direct_peer_table_h table, bool visible);
+
+/**
+ * @brief Checks whether peer history is enabled or not.
+ * @param[out] enabled  Indicates whether peer history is enabled or not
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_peer_history()
+ */
+int wifi_direct_is_peer_history_enabled(bool* enabled);
+
+/**
+ * @brief Sets the maximum age of peers in peer history.
+ * @details Peers not seen for @a sec seconds are removed at the next compaction.
+ * @param[in] sec  The maximum age in seconds. If 0, a default value will be used.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_peer_history_max_age()
+ */
+int wifi_direct_set_peer_history_max_age(int sec);
+
+/**
+ * @brief Gets the maximum age of peers in peer history.
+ * @param[out] sec  The maximum age in seconds
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_peer_history_max_age()
+ */
+int wifi_direct_get_peer_history_max_age(int* sec);
+
+/**
+ * @brief Removes all peers from peer history.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_peer_history()
+ */
+int wifi_direct_clear_peer_history(void);
+
+/**
+ * @brief Confirms stale peers by probing them, asynchronous.
+ * @details Each stale peer is probed on its last known channel instead of running a full discovery.
+ * A peer which answers is not stale any more and is notified by wifi_direct_discovery_state_chagned_cb() with #WIFI_DIRECT_DISCOVERY_FOUND.
+ * A peer which does not answer is removed from the discovered peers, but is kept in the persisted peer history
+ * until it is older than the maximum age set by wifi_direct_set_peer_history_max_age(), so it is stale again after the Wi-Fi Direct service restarts.
+ * While stale peers are probed, the state of Wi-Fi Direct service is #WIFI_DIRECT_STATE_DISCOVERING,
+ * and it goes back to #WIFI_DIRECT_STATE_ACTIVATED when all stale peers are probed.
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre The state of Wi-Fi Direct service must be #WIFI_DIRECT_STATE_ACTIVATED.
+ * @post wifi_direct_discovery_state_chagned_cb() will be invoked with #WIFI_DIRECT_DISCOVERY_FINISHED when all stale peers are probed.
+ * @see wifi_direct_get_state()
+ * @see wifi_direct_set_stale_peers_visible()
+ * @see wifi_direct_foreach_discovered_peers()
+ */
+int wifi_direct_confirm_stale_peers(void);
+
+/**
+ * @brief Sets the power profile of local device.
+ * @details The profile is applied to the group of local device and to every peer which has no power profile of its own.
+ * @param[in] profile  The power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_power_profile()
+ * @see wifi_direct_set_peer_power_profile()
+ */
+int wifi_direct_set_power_profile(wifi_direct_power_profile_e profile);
+
+/**
+ * @brief Gets the power profile of local device.
+ * @param[out] profile  The power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_power_profile()
+ */
+int wifi_direct_get_power_profile(wifi_direct_power_profile_e* profile);
+
+/**
+ * @brief Sets the power profile of a connected peer.
+ * @details The profile has priority over the power profile of local device for the link to the peer.
+ * When your device is group owner, Notice of Absence is scheduled so as to meet the profile with lowest latency among connected peers.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[in] profile  The power profile, or #WIFI_DIRECT_POWER_PROFILE_DEFAULT to follow the power profile of local device
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_set_peer_power_profile_mac()
+ * @see wifi_direct_get_peer_power_profile()
+ * @see wifi_direct_set_power_profile()
+ */
+int wifi_direct_set_peer_power_profile(const char* mac_address, wifi_direct_power_profile_e profile);
+
+/**
+ * @brief Sets the power profile of a connected peer given by MAC address in binary form.
+ * @details This API works like wifi_direct_set_peer_power_profile() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[in] profile  The power profile, or #WIFI_DIRECT_POWER_PROFILE_DEFAULT to follow the power profile of local device
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_set_peer_power_profile()
+ * @see wifi_direct_get_peer_power_profile_mac()
+ */
+int wifi_direct_set_peer_power_profile_mac(const wifi_direct_mac_s* mac_address, wifi_direct_power_profile_e profile);
+
+/**
+ * @brief Gets the power profile of a connected peer.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] profile  The power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_peer_power_profile_mac()
+ * @see wifi_direct_set_peer_power_profile()
+ */
+int wifi_direct_get_peer_power_profile(const char* mac_address, wifi_direct_power_profile_e* profile);
+
+/**
+ * @brief Gets the power profile of a connected peer given by MAC address in binary form.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] profile  The power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_peer_power_profile()
+ * @see wifi_direct_set_peer_power_profile_mac()
+ */
+int wifi_direct_get_peer_power_profile_mac(const wifi_direct_mac_s* mac_address, wifi_direct_power_profile_e* profile);
+
+/**
+ * @brief Sets the parameters of a power profile.
+ * @remarks The parameters of #WIFI_DIRECT_POWER_PROFILE_DEFAULT cannot be changed, and #WIFI_DIRECT_ERROR_NOT_PERMITTED is returned for it.
+ * If @a listen_interval_usec or @a ct_window_usec of @a params is not a multiple of 1024, #WIFI_DIRECT_ERROR_INVALID_PARAMETER is returned.
+ * @param[in] profile  The power profile
+ * @param[in] params  The parameters of the power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_get_power_profile_params()
+ * @see wifi_direct_get_power_stats()
+ */
+int wifi_direct_set_power_profile_params(wifi_direct_power_profile_e profile, const wifi_direct_power_profile_params_s* params);
+
+/**
+ * @brief Gets the parameters of a power profile.
+ * @param[in] profile  The power profile
+ * @param[out] params  The parameters of the power profile
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be initialized by wifi_direct_initialize().
+ * @see wifi_direct_initialize()
+ * @see wifi_direct_set_power_profile_params()
+ */
+int wifi_direct_get_power_profile_params(wifi_direct_power_profile_e profile, wifi_direct_power_profile_params_s* params);
+
+/**
+ * @brief Gets the latency and duty cycle of local device measured since the power profile was applied.
+ * @param[out] stats  The measured latency and duty cycle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_set_power_profile()
+ * @see wifi_direct_get_peer_power_stats()
+ */
+int wifi_direct_get_power_stats(wifi_direct_power_stats_s* stats);
+
+/**
+ * @brief Gets the latency and duty cycle of the link to a connected peer measured since the power profile was applied.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] stats  The measured latency and duty cycle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_set_peer_power_profile()
+ * @see wifi_direct_get_peer_power_stats_mac()
+ */
+int wifi_direct_get_peer_power_stats(const char* mac_address, wifi_direct_power_stats_s* stats);
+
+/**
+ * @brief Gets the latency and duty cycle of the link to a connected peer given by MAC address in binary form.
+ * @details This API works like wifi_direct_get_peer_power_stats() without parsing the MAC address string.
+ * @param[in] mac_address  The MAC address of connected peer
+ * @param[out] stats  The measured latency and duty cycle
+ * @return 0 on success, otherwise a negative error value.
+ * @retval #WIFI_DIRECT_ERROR_NONE  Successful
+ * @retval #WIFI_DIRECT_ERROR_INVALID_PARAMETER  Invalid parameter
+ * @retval #WIFI_DIRECT_ERROR_OPERATION_FAILED  Operation failed
+ * @retval #WIFI_DIRECT_ERROR_COMMUNICATION_FAILED  Communication failed
+ * @retval #WIFI_DIRECT_ERROR_NOT_PERMITTED  Operation not permitted
+ * @retval #WIFI_DIRECT_ERROR_NOT_INITIALIZED  Not initialized
+ * @retval #WIFI_DIRECT_ERROR_RESOURCE_BUSY  Device or resource busy
+ * @pre Wi-Fi Direct service must be activated by wifi_direct_activate().
+ * @see wifi_direct_activate()
+ * @see wifi_direct_get_peer_power_stats()
+ * @see wifi_direct_set_peer_power_profile_mac()
+ */
+int wifi_direct_get_peer_power_stats_mac(const wifi_direct_mac_s* mac_address, wifi_direct_power_stats_s* stats);
+
 /**
  * @}
  */
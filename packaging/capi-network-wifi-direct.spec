@@ -1,7 +1,7 @@
 Name:       capi-network-wifi-direct
 Summary:    Network WiFi-Direct library in Tizen CAPI
-Version: 0.0.4
-Release:    5
+Version: 0.0.5
+Release:    1
 Group:      TO_BE_FILLED
 License:    TO_BE_FILLED
 Source0:    %{name}-%{version}.tar.gz
@@ -16,11 +16,13 @@ BuildRequires:  cmake
 %description
 
 %define debug_package %{nil}  
+%define wifi_direct_version %(pkg-config --modversion wifi-direct 2>/dev/null || echo 0)
 
 %package devel 
 Summary:    WiFi-Direct library (Shared Library) (Developement)
 Group:      TO_BE_FILLED 
 Requires: capi-base-common-devel
+Requires: libwifi-direct >= %{wifi_direct_version}
 BuildRequires:  pkgconfig(wifi-direct)
 %description devel
 WiFi-Direct library (Shared Library) (Developement)